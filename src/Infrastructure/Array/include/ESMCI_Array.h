@@ -229,6 +229,7 @@ namespace ESMCI {
                                       // between exclusive and total bounds
                                       // [localDeCount][rimElementCount[]]
     std::vector<int> rimElementCount; // numb. of elements in rim [localDeCount]
+    bool rimSeqIndexUserFlag;         // rim seqIndex set via setRimSeqIndex()
     // special variables for super-vectorization in XXE
     int *sizeSuperUndist;   // [redDimCount+1]
     int *sizeDist;          // [redDimCount*localDeCount]
@@ -282,6 +283,7 @@ namespace ESMCI {
 #endif
       rimLinIndex.resize(0);
       rimElementCount.resize(0);
+      rimSeqIndexUserFlag = false;
       localDeCountAux = 0;  // auxiliary variable for garbage collection
       vmAux = vm;
       ioRH = NULL;
@@ -321,6 +323,7 @@ namespace ESMCI {
 #endif
       rimLinIndex.resize(0);
       rimElementCount.resize(0);
+      rimSeqIndexUserFlag = false;
       localDeCountAux = 0;  // auxiliary variable for garbage collection
       vmAux = NULL;
       ioRH = NULL;
@@ -459,6 +462,10 @@ namespace ESMCI {
       int *counts, int *tile, int rootPet, VM *vm);
     int scatter(void *array, ESMC_TypeKind_Flag typekind, int rank,
       int *counts, int *tile, int rootPet, VM *vm);
+   private:
+    int gatherScatterPipelined(void *array, int *counts, int tile,
+      int rootPet, VM *vm, bool scatterFlag, int chunkSize, int ssiPetCount);
+   public:
     static int haloStore(Array *array, RouteHandle **routehandle,
       ESMC_HaloStartRegionFlag halostartregionflag=ESMF_REGION_EXCLUSIVE,
       InterArray<int> *haloLDepth=NULL, InterArray<int> *haloUDepth=NULL,
@@ -468,6 +475,13 @@ namespace ESMCI {
       ESMC_HaloStartRegionFlag halostartregionflag=ESMF_REGION_EXCLUSIVE,
       InterArray<int> *haloLDepth=NULL, InterArray<int> *haloUDepth=NULL,
       int *pipelineDepthArg=NULL);
+    template<typename IT>
+      static int tHaloStoreStructured(Array *array, RouteHandle **routehandle,
+      std::vector<std::vector<int> > const &haloInsideLBound,
+      std::vector<std::vector<int> > const &haloOutsideLBound,
+      std::vector<std::vector<int> > const &haloInsideUBound,
+      std::vector<std::vector<int> > const &haloOutsideUBound,
+      int *pipelineDepthArg, bool *structuredFlag);
     static int halo(Array *array,
       RouteHandle **routehandle, ESMC_CommFlag commflag=ESMF_COMM_BLOCKING,
       bool *finishedflag=NULL, bool *cancelledflag=NULL, bool checkflag=false);
@@ -491,13 +505,15 @@ namespace ESMCI {
       RouteHandle **routehandle,
       std::vector<SparseMatrix<SIT,DIT> > const &sparseMatrix,
       bool haloFlag=false, bool ignoreUnmatched=false,
-      int *srcTermProcessingArg=NULL, int *pipelineDepthArg=NULL);
+      int *srcTermProcessingArg=NULL, int *pipelineDepthArg=NULL,
+      bool productSumCsr=false);
     template<typename SIT, typename DIT>
       static int tSparseMatMulStore(Array *srcArray, Array *dstArray,
       RouteHandle **routehandle,
       std::vector<SparseMatrix<SIT,DIT> > const &sparseMatrix,
       bool haloFlag=false, bool ignoreUnmatched=false,
-      int *srcTermProcessingArg=NULL, int *pipelineDepthArg=NULL);
+      int *srcTermProcessingArg=NULL, int *pipelineDepthArg=NULL,
+      bool productSumCsr=false);
     static int sparseMatMul(Array *srcArray, Array *dstArray,
       RouteHandle **routehandle, ESMC_CommFlag commflag=ESMF_COMM_BLOCKING,
       bool *finishedflag=NULL, bool *cancelledflag=NULL,
@@ -1222,6 +1222,21 @@ template<typename IT1, typename IT2>
       *((ESMC_I8 *)a) += *((ESMC_I8 *)b);
   }
 
+  // -------------------------------------------------
+  // Exchange the per-PET counts that set up the distributed directory
+  // rendezvous. ESMF_RUNTIME_SMM_RENDEZVOUS selects the exchange: DENSE
+  // (default) uses alltoall(), SPARSE only communicates non-zero counts, and
+  // SSI additionally aggregates the non-zero counts on each SSI.
+  int exchangeCounts(VM *vm, int *countToPet, int *countFromPet){
+    char const *mode = VM::getenv("ESMF_RUNTIME_SMM_RENDEZVOUS");
+    if (mode && std::string(mode) == "SPARSE")
+      return vm->sparse_alltoall(countToPet, countFromPet);
+    if (mode && std::string(mode) == "SSI")
+      return vm->sparse_alltoall(countToPet, countFromPet, true);
+    return vm->alltoall(countToPet, sizeof(int), countFromPet, sizeof(int),
+      vmBYTE);
+  }
+
   // -------------------------------------------------
 #undef  ESMC_METHOD
 #define ESMC_METHOD "ESMCI::DD::setupSeqIndexFactorLookup()"
@@ -1244,38 +1259,61 @@ template<typename IT1, typename IT2>
     VM::logMemInfo(std::string("setupSeqIndexFactorLookup1"));
 #endif
 
+    // The local factorList is ingested into the distributed directory in
+    // chunks of bounded size. This limits the memory held by the per-PET index
+    // lists and message buffers below, independent of the number of factors
+    // on the PET. All PETs iterate over the same number of chunks.
+    long int chunkSize = 1048576;
+    char const *chunkSizeEnv = VM::getenv("ESMF_RUNTIME_SMM_FACTOR_CHUNK");
+    if (chunkSizeEnv && atol(chunkSizeEnv) > 0) chunkSize = atol(chunkSizeEnv);
+    int localChunkCount = (int)((factorListCount + chunkSize - 1) / chunkSize);
+    int chunkCount;
+    localrc = vm->allreduce(&localChunkCount, &chunkCount, 1, vmI4, vmMAX);
+    if (ESMC_LogDefault.MsgFoundError(localrc, ESMCI_ERR_PASSTHRU,
+      ESMC_CONTEXT, &localrc)) return localrc;
+    if (chunkCount < 1) chunkCount = 1; // always set up the directory
+
     // set up seqIntervFactorListCountToPet and seqIntervFactorListIndexToPet
     vector<int> seqIntervFactorListCountToPet(petCount);
-    for (int i=0; i<petCount; i++)
-      seqIntervFactorListCountToPet[i] = 0; // reset
     vector<vector<int> > seqIntervFactorListIndexToPet(petCount);
     vector<vector<int> > seqIntervFactorListLookupIndexToPet(petCount);
+    vector<int> seqIntervFactorListCountFromPet(petCount);
     
 #ifdef ASMM_STORE_MEMLOG_on
     VM::logMemInfo(std::string("setupSeqIndexFactorLookup2"));
 #endif
 
-    for (int j=0; j<factorListCount; j++){
-      // loop over all factorList entries, find matching interval via bisection
-      // and count factor towards those that need to be sent to that PET.
-      SeqInd<IT> seqInd;
-      if (dstSetupFlag)
-        seqInd = sparseMatrix[0].getDstSeqIndex(j);
-      else
-        seqInd = sparseMatrix[0].getSrcSeqIndex(j);
+    for (int chunk=0; chunk<chunkCount; chunk++){
+      int jStart = (int)min((long int)factorListCount, chunk * chunkSize);
+      int jEnd = (int)min((long int)factorListCount, (chunk+1) * chunkSize);
+      for (int i=0; i<petCount; i++){
+        seqIntervFactorListCountToPet[i] = 0; // reset
+        seqIntervFactorListIndexToPet[i].clear();
+        seqIntervFactorListLookupIndexToPet[i].clear();
+      }
+
+      for (int j=jStart; j<jEnd; j++){
+        // loop over the factorList entries of this chunk, find matching
+        // interval via bisection and count factor towards those that need to
+        // be sent to that PET.
+        SeqInd<IT> seqInd;
+        if (dstSetupFlag)
+          seqInd = sparseMatrix[0].getDstSeqIndex(j);
+        else
+          seqInd = sparseMatrix[0].getSrcSeqIndex(j);
 #if 0
 seqInd.print();
 #endif
-      IT seqIndex = seqInd.getIndex(0);
-      IT tensorSeqIndex;
-      if (tensorMixFlag)
-        tensorSeqIndex = seqInd.getIndex(1);
-      else
-        tensorSeqIndex = 1;  // dummy
-      int iMin=0, iMax=petCount-1;
-      int i=petCount/2;
-      bool foundFlag=false;     // reset
-      do{
+        IT seqIndex = seqInd.getIndex(0);
+        IT tensorSeqIndex;
+        if (tensorMixFlag)
+          tensorSeqIndex = seqInd.getIndex(1);
+        else
+          tensorSeqIndex = 1;  // dummy
+        int iMin=0, iMax=petCount-1;
+        int i=petCount/2;
+        bool foundFlag=false;     // reset
+        do{
 #if 0
 cout << "dstSetupFlag=" << dstSetupFlag << " seqIndex=" << seqIndex << " i=" <<
   i << " iMin=" << iMin << " iMax=" << iMax << " seqIndexInterval[].min=" << 
@@ -1284,116 +1322,131 @@ cout << "dstSetupFlag=" << dstSetupFlag << " seqIndex=" << seqIndex << " i=" <<
 cout << "dstSetupFlag=" << dstSetupFlag << " tensorSeqIndex=" <<
   tensorSeqIndex << " tensorElementCountEff=" << tensorElementCountEff << "\n";
 #endif
-        if (seqIndex < seqIndexInterval[i].min){
-          iMax = i;
-          i = iMin + (iMax - iMin) / 2;
-          continue; 
-        }
-        if (seqIndex > seqIndexInterval[i].max){
-          iMin = i;
-          i = iMin + 1 + (iMax - iMin) / 2;
-          continue; 
-        }
-        // found interval -> check if tensorSeqIndex is within bounds
-        if (tensorSeqIndex < 1 || tensorSeqIndex > tensorElementCountEff){
-          // tensorSeqIndex outside Array bounds
+          if (seqIndex < seqIndexInterval[i].min){
+            iMax = i;
+            i = iMin + (iMax - iMin) / 2;
+            continue; 
+          }
+          if (seqIndex > seqIndexInterval[i].max){
+            iMin = i;
+            i = iMin + 1 + (iMax - iMin) / 2;
+            continue; 
+          }
+          // found interval -> check if tensorSeqIndex is within bounds
+          if (tensorSeqIndex < 1 || tensorSeqIndex > tensorElementCountEff){
+            // tensorSeqIndex outside Array bounds
+            ESMC_LogDefault.MsgFoundError(ESMC_RC_ARG_BAD,
+              "factorIndexList contains tensorSeqIndex outside Array bounds",
+              ESMC_CONTEXT, &localrc);
+            return localrc;
+          }
+          foundFlag = true;  // set
+          ++seqIntervFactorListCountToPet[i]; // count this factor for this Pet
+          seqIntervFactorListIndexToPet[i].push_back(j); // store factorList ind
+          // determine lookupIndex and store
+          int lookupIndex = (int)(seqIndex - seqIndexInterval[i].min);
+          if (tensorMixFlag)
+            lookupIndex +=
+              (int)((tensorSeqIndex - 1) * seqIndexInterval[i].count);
+          seqIntervFactorListLookupIndexToPet[i].push_back(lookupIndex);
+          break;
+        }while (iMin != iMax);
+        if (!ignoreUnmatched && !foundFlag){
+          // seqIndex lies outside Array bounds
           ESMC_LogDefault.MsgFoundError(ESMC_RC_ARG_BAD,
-            "factorIndexList contains tensorSeqIndex outside Array bounds",
+            "factorIndexList contains seqIndex outside Array bounds",
             ESMC_CONTEXT, &localrc);
           return localrc;
         }
-        foundFlag = true;  // set
-        ++seqIntervFactorListCountToPet[i]; // count this factor for this Pet
-        seqIntervFactorListIndexToPet[i].push_back(j); // store factorList ind.
-        // determine lookupIndex and store
-        int lookupIndex = (int)(seqIndex - seqIndexInterval[i].min);
-        if (tensorMixFlag)
-          lookupIndex += (int)((tensorSeqIndex - 1) * seqIndexInterval[i].count);
-        seqIntervFactorListLookupIndexToPet[i].push_back(lookupIndex); // store
-        break;
-      }while (iMin != iMax);
-      if (!ignoreUnmatched && !foundFlag){
-        // seqIndex lies outside Array bounds
-        ESMC_LogDefault.MsgFoundError(ESMC_RC_ARG_BAD,
-          "factorIndexList contains seqIndex outside Array bounds",
-          ESMC_CONTEXT, &localrc);
-        return localrc;
       }
-    }
+
 
 #ifdef ASMM_STORE_MEMLOG_on
-    VM::logMemInfo(std::string("setupSeqIndexFactorLookup3"));
+      VM::logMemInfo(std::string("setupSeqIndexFactorLookup3"));
 #endif
 
-    // construct seqIntervFactorListCountFromPet
-    vector<int> seqIntervFactorListCountFromPet(petCount);
-    vm->alltoall(&(seqIntervFactorListCountToPet.front()), sizeof(int),
-      &(seqIntervFactorListCountFromPet.front()), sizeof(int), vmBYTE);
+      // construct seqIntervFactorListCountFromPet
+      localrc = exchangeCounts(vm, &(seqIntervFactorListCountToPet.front()),
+        &(seqIntervFactorListCountFromPet.front()));
+      if (ESMC_LogDefault.MsgFoundError(localrc, ESMCI_ERR_PASSTHRU,
+        ESMC_CONTEXT, &localrc)) return localrc;
     
 #ifdef DEBUGLOG
-    {
-      std::stringstream debugmsg;
-      debugmsg << "setupSeqIndexFactorLookup() seqIntervFactorListCountToPet=";
-      for (int i=0; i<seqIntervFactorListCountToPet.size(); i++)
-        debugmsg << seqIntervFactorListCountToPet[i] << ", ";
-      ESMC_LogDefault.Write(debugmsg.str(), ESMC_LOGMSG_DEBUG);
-    }
-    {
-      std::stringstream debugmsg;
-      debugmsg << "setupSeqIndexFactorLookup() seqIntervFactorListCountFromPet=";
-      for (int i=0; i<seqIntervFactorListCountFromPet.size(); i++)
-        debugmsg << seqIntervFactorListCountFromPet[i] << ", ";
-      ESMC_LogDefault.Write(debugmsg.str(), ESMC_LOGMSG_DEBUG);
-    }
+      {
+        std::stringstream debugmsg;
+        debugmsg <<
+          "setupSeqIndexFactorLookup() seqIntervFactorListCountToPet=";
+        for (int i=0; i<seqIntervFactorListCountToPet.size(); i++)
+          debugmsg << seqIntervFactorListCountToPet[i] << ", ";
+        ESMC_LogDefault.Write(debugmsg.str(), ESMC_LOGMSG_DEBUG);
+      }
+      {
+        std::stringstream debugmsg;
+        debugmsg <<
+          "setupSeqIndexFactorLookup() seqIntervFactorListCountFromPet=";
+        for (int i=0; i<seqIntervFactorListCountFromPet.size(); i++)
+          debugmsg << seqIntervFactorListCountFromPet[i] << ", ";
+        ESMC_LogDefault.Write(debugmsg.str(), ESMC_LOGMSG_DEBUG);
+      }
 #endif
 
 #ifdef ASMM_STORE_MEMLOG_on
-    VM::logMemInfo(std::string("setupSeqIndexFactorLookup4"));
-#endif
-
-    DD::SetupSeqIndexFactorLookupStage1<IT> setupSeqIndexFactorLookupStage1(
-      seqIndexFactorLookup,
-      localPet,
-      petCount,
-      (sparseMatrix.size()==0) ? NULL : &(sparseMatrix[0]),
-      factorPetFlag,
-      seqIndexInterval,
-      seqIntervFactorListCountToPet,
-      seqIntervFactorListIndexToPet,
-      seqIntervFactorListLookupIndexToPet,
-      seqIntervFactorListCountFromPet,
-      tensorMixFlag,
-      dstSetupFlag,
-      typekindFactors);
+      VM::logMemInfo(std::string("setupSeqIndexFactorLookup4"));
+#endif
+
+      DD::SetupSeqIndexFactorLookupStage1<IT>
+        setupSeqIndexFactorLookupStage1(
+        seqIndexFactorLookup,
+        localPet,
+        petCount,
+        (sparseMatrix.size()==0) ? NULL : &(sparseMatrix[0]),
+        factorPetFlag,
+        seqIndexInterval,
+        seqIntervFactorListCountToPet,
+        seqIntervFactorListIndexToPet,
+        seqIntervFactorListLookupIndexToPet,
+        seqIntervFactorListCountFromPet,
+        tensorMixFlag,
+        dstSetupFlag,
+        typekindFactors);
       
 #define WITH_RESERVE
 #ifdef WITH_RESERVE
-    // Determine factorCount in stage1 and use to reserve memory of vector
-    // before using it in stage2. Not sure this is really an improvement over
-    // just dealing with memory allocation hit, b/c it does require extra
-    // communication.
-    
-    setupSeqIndexFactorLookupStage1.totalExchange(vm);
-    
-    for (typename vector<SeqIndexFactorLookup<IT> >::iterator
-      i=seqIndexFactorLookup.begin(); i!=seqIndexFactorLookup.end(); ++i){
-      // obtain memory
-      i->factorList.reserve(i->factorCount);  
-    }
+      if (chunkCount == 1){
+        // Determine factorCount in stage1 and use to reserve memory of vector
+        // before using it in stage2. Not sure this is really an improvement
+        // over just dealing with memory allocation hit, b/c it does require
+        // extra communication. Incremental reservation across several chunks
+        // would lead to repeated reallocation, so it is only done for one.
+      
+        setupSeqIndexFactorLookupStage1.totalExchange(vm);
+      
+        for (typename vector<SeqIndexFactorLookup<IT> >::iterator
+          i=seqIndexFactorLookup.begin(); i!=seqIndexFactorLookup.end(); ++i){
+          // obtain memory
+          i->factorList.reserve(i->factorCount);  
+        }
+      }
 #endif
 
 #ifdef ASMM_STORE_MEMLOG_on
-    VM::logMemInfo(std::string("setupSeqIndexFactorLookup5"));
+      VM::logMemInfo(std::string("setupSeqIndexFactorLookup5"));
 #endif
     
-    DD::SetupSeqIndexFactorLookupStage2<IT>
-      setupSeqIndexFactorLookupStage2(setupSeqIndexFactorLookupStage1);
+      DD::SetupSeqIndexFactorLookupStage2<IT>
+        setupSeqIndexFactorLookupStage2(setupSeqIndexFactorLookupStage1);
 
 #ifdef ASMM_STORE_MEMLOG_on
-    VM::logMemInfo(std::string("setupSeqIndexFactorLookup6"));
+      VM::logMemInfo(std::string("setupSeqIndexFactorLookup6"));
 #endif
 
-    setupSeqIndexFactorLookupStage2.totalExchange(vm);
+      setupSeqIndexFactorLookupStage2.totalExchange(vm);
+    }
+
+    // factorCount is only known ahead of time for a single chunk, reset here
+    for (typename vector<SeqIndexFactorLookup<IT> >::iterator
+      i=seqIndexFactorLookup.begin(); i!=seqIndexFactorLookup.end(); ++i)
+      i->factorCount = i->factorList.size();
     
 #ifdef ASMM_STORE_MEMLOG_on
     VM::logMemInfo(std::string("setupSeqIndexFactorLookup7"));
@@ -1831,8 +1884,10 @@ template<typename SIT, typename DIT> int sparseMatMulStoreLinSeqVect(
   VMK::wtime(&t4a3);   //gjt - profile
 #endif
   
-  vm->alltoall(srcLocalElementsPerIntervalCount, sizeof(int),
-    srcLocalIntervalPerPetCount, sizeof(int), vmBYTE);
+  localrc = DD::exchangeCounts(vm, srcLocalElementsPerIntervalCount,
+    srcLocalIntervalPerPetCount);
+  if (ESMC_LogDefault.MsgFoundError(localrc, ESMCI_ERR_PASSTHRU, ESMC_CONTEXT,
+    &rc)) return rc;
   
 #ifdef ASMM_STORE_TIMING_on
   VMK::wtime(&t4a);   //gjt - profile
@@ -1968,8 +2023,10 @@ template<typename SIT, typename DIT> int sparseMatMulStoreLinSeqVect(
   VMK::wtime(&t4b3);   //gjt - profile
 #endif
 
-  vm->alltoall(dstLocalElementsPerIntervalCount, sizeof(int),
-    dstLocalIntervalPerPetCount, sizeof(int), vmBYTE);
+  localrc = DD::exchangeCounts(vm, dstLocalElementsPerIntervalCount,
+    dstLocalIntervalPerPetCount);
+  if (ESMC_LogDefault.MsgFoundError(localrc, ESMCI_ERR_PASSTHRU, ESMC_CONTEXT,
+    &rc)) return rc;
   
 #ifdef ASMM_STORE_TIMING_on
   VMK::wtime(&t4b);   //gjt - profile
@@ -2093,8 +2150,10 @@ template<typename SIT, typename DIT> int sparseMatMulStoreLinSeqVect(
     srcLocalPartnerElementsPerIntervalCount[i] = count;
   }
   int *dstLocalPartnerIntervalPerPetCount = new int[petCount];
-  vm->alltoall(srcLocalPartnerElementsPerIntervalCount, sizeof(int),
-    dstLocalPartnerIntervalPerPetCount, sizeof(int), vmBYTE);
+  localrc = DD::exchangeCounts(vm, srcLocalPartnerElementsPerIntervalCount,
+    dstLocalPartnerIntervalPerPetCount);
+  if (ESMC_LogDefault.MsgFoundError(localrc, ESMCI_ERR_PASSTHRU, ESMC_CONTEXT,
+    &rc)) return rc;
   
 #ifdef ASMM_STORE_MEMLOG_on
   VM::logMemInfo(std::string("ASMMStore2.17"));
@@ -2144,8 +2203,10 @@ template<typename SIT, typename DIT> int sparseMatMulStoreLinSeqVect(
     dstLocalPartnerElementsPerIntervalCount[i] = count;
   }
   int *srcLocalPartnerIntervalPerPetCount = new int[petCount];
-  vm->alltoall(dstLocalPartnerElementsPerIntervalCount, sizeof(int),
-    srcLocalPartnerIntervalPerPetCount, sizeof(int), vmBYTE);
+  localrc = DD::exchangeCounts(vm, dstLocalPartnerElementsPerIntervalCount,
+    srcLocalPartnerIntervalPerPetCount);
+  if (ESMC_LogDefault.MsgFoundError(localrc, ESMCI_ERR_PASSTHRU, ESMC_CONTEXT,
+    &rc)) return rc;
   
 #ifdef ASMM_STORE_MEMLOG_on
   VM::logMemInfo(std::string("ASMMStore2.19"));
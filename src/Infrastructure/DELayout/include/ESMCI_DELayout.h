@@ -307,7 +307,13 @@ class XXE{
       // --- nop
       nop,
       // --- ids below are not suitable for direct execution
-      waitOnAllSendnb, waitOnAllRecvnb
+      waitOnAllSendnb, waitOnAllRecvnb,
+      // --- ids are streamified as plain integers, e.g. into RouteHandle
+      // --- files, so new ids are appended here to keep the existing ones
+      // --- product and sum
+      productSumCsrDstRRA,
+      // --- mem movement
+      memGatherSrcRRABlock, memScatterDstRRABlock
     };
     enum TKId{
       I4, I8, R4, R8, BYTE
@@ -352,6 +358,7 @@ class XXE{
     static int const filterBitNbWaitFinish      = 0x10; // non-block wait&finish
     static int const filterBitCancel            = 0x20; // cancel
     static int const filterBitNbWaitFinishSingleSum = 0x40; // single sum
+    static int const filterBitNbStartLocal      = 0x80; // local in nb start
 
     struct BufferInfo{
       // The BufferInfo provides an extra level of indirection to XXE managed
@@ -410,12 +417,30 @@ class XXE{
     // MISC
     int lastFilterBitField;         // filterBitField during last exec() call
     bool superVectorOkay;           // flag to indicate that super-vector okay
+    int execThreadCount;            // number of threads used by local compute
+                                    // ops (productSum, memGather, zero) during
+                                    // exec(), 1 for serial execution
+    bool productSumCsr;             // flag to indicate that productSum terms
+                                    // are to be encoded in CSR format, only
+                                    // used during store
+    bool persistentComm;            // flag to indicate that sendnb/recvnb
+                                    // ops are executed via persistent MPI
+                                    // requests, bound on first exec()
+    bool ssiShmComm;                // flag to indicate that sendnb/recvnb
+                                    // ops between PETs on the same SSI are
+                                    // executed via SSI shared memory channels
   private:
     int max;                        // maximum number of elements in stream
     int dataMaxCount;               // maximum number of elements in data
     int commhandleMaxCount;         // maximum number of elements in commhandle
     int xxeSubMaxCount;             // maximum number of elements in xxeSubList
     RouteHandle *rh;                // associated RouteHandle
+    bool ssiShmReady;               // SSI shared memory channels are set up
+    // scratch space of exec() for completing waits in a single batch
+    std::vector<int> waitIndexList;           // opstream index of comm op
+    std::vector<VMK::commhandle**> waitCommhList;
+    std::vector<VMK::status> waitStatusList;
+    int execWaitAll(bool *cancelled);
     
   public:
     XXE(VM *vmArg, int maxArg=1000, int dataMaxCountArg=1000,
@@ -436,6 +461,11 @@ class XXE{
       bufferInfoList.reserve(40000);  // initial preparation
       lastFilterBitField = 0x0;
       superVectorOkay = true;
+      execThreadCount = 1;
+      productSumCsr = false;
+      persistentComm = false;
+      ssiShmComm = false;
+      ssiShmReady = false;
       rh = NULL;
     }
     XXE(std::stringstream &streami,
@@ -495,6 +525,8 @@ class XXE{
       int filterBitField=0x0, int indexStart=-1, int indexStop=-1);
     int printProfile(FILE *fp);
     int execReady();
+    int ssiShmSetup();
+    void getSendnbPetList(std::vector<int> &petList);
     int optimize();
     int optimizeElement(int index);
     
@@ -550,11 +582,20 @@ class XXE{
     int appendSendnbRRA(int predicateBitField, int rraOffset,
       unsigned long long int size, int dstPet, int rraIndex,
       int tag=-1, bool vectorFlag=false);
+    int appendRecvnbRRA(int predicateBitField, int rraOffset,
+      unsigned long long int size, int srcPet, int rraIndex,
+      int tag=-1, bool vectorFlag=false);
     int appendMemCpySrcRRA(int predicateBitField, int rraOffset,
       unsigned long long int size, void *dstMem, int rraIndex);
     int appendMemGatherSrcRRA(int predicateBitField, void *dstBase,
       TKId dstBaseTK, int rraIndex, int chunkCount, bool vectorFlag=false,
       bool indirectionFlag=false);
+    int appendMemGatherSrcRRABlock(int predicateBitField, void *dstBase,
+      TKId dstBaseTK, int rraIndex, int blockCount, bool vectorFlag=false,
+      bool indirectionFlag=false);
+    int appendMemScatterDstRRABlock(int predicateBitField, void *srcBase,
+      TKId srcBaseTK, int rraIndex, int blockCount, bool vectorFlag=false,
+      bool indirectionFlag=false);
     int appendZeroScalarRRA(int predicateBitField, TKId elementTK,
       int rraOffset, int rraIndex);
     int appendZeroSuperScalarRRA(int predicateBitField, TKId elementTK,
@@ -587,6 +628,12 @@ class XXE{
     int appendProductSumSuperScalarSrcRRA(int predicateBitField, TKId elementTK,
       TKId valueTK, TKId factorTK, int rraIndex, int termCount,
       void *elementBase, bool vectorFlag=false, bool indirectionFlag=false);
+    int appendProductSumCsrDstRRA(int predicateBitField, TKId elementTK,
+      TKId valueTK, TKId factorTK, int rraIndex, int rowCount, int termCount,
+      void *valueBase, bool vectorFlag=false, bool indirectionFlag=false);
+    void getProductSumCsrStats(int *opCount, long *rowCount, long *termCount)
+      const;
+    int getOpCount(OpId opId)const;
     int appendWaitOnIndex(int predicateBitField, int index);
     int appendTestOnIndex(int predicateBitField, int index);
     int appendWaitOnAnyIndexSub(int predicateBitField, int count);
@@ -944,6 +991,24 @@ class XXE{
       bool indirectionFlag;
     }ProductSumSuperScalarContigRRAInfo;
 
+    typedef struct{
+      OpId opId;
+      int predicateBitField;
+      TKId elementTK;
+      TKId factorTK;
+      TKId valueTK;
+      int *rowOffsetList;     // rra offset of dst element of each row
+      int *rowStartList;      // rowCount+1 entries into term lists
+      void *factorList;
+      void *valueBase;
+      int rraIndex;
+      int rowCount;
+      int termCount;
+      bool vectorFlag;
+      bool indirectionFlag;
+      int *valueOffsetList;
+    }ProductSumCsrDstRRAInfo;
+
     typedef struct{
       OpId opId;
       int predicateBitField;
@@ -1009,6 +1074,34 @@ class XXE{
       bool indirectionFlag;
     }MemGatherSrcRRAInfo;
     
+    // strided blocks: offset followed by (count, stride) for each block dim
+    static const int blockDimCount = 3;
+    static const int blockSize = 1 + 2*blockDimCount;
+
+    typedef struct{
+      OpId opId;
+      int predicateBitField;
+      void *dstBase;
+      TKId dstBaseTK;
+      int *blockList;       // [blockCount*blockSize]
+      int rraIndex;
+      int blockCount;
+      bool vectorFlag;
+      bool indirectionFlag;
+    }MemGatherSrcRRABlockInfo;
+    
+    typedef struct{
+      OpId opId;
+      int predicateBitField;
+      void *srcBase;
+      TKId srcBaseTK;
+      int *blockList;       // [blockCount*blockSize]
+      int rraIndex;
+      int blockCount;
+      bool vectorFlag;
+      bool indirectionFlag;
+    }MemScatterDstRRABlockInfo;
+    
     // --- sub-opstreams
     
     typedef struct{
@@ -1108,17 +1201,28 @@ class XXE{
     }MultiSubInfo;
     
   private:
+    inline static void exec_zeroMemset(char *buffer,
+      unsigned long long int byteCount, int threadCount);
     template<typename T>
     inline static void exec_memGatherSrcRRA(
-      MemGatherSrcRRAInfo *xxeMemGatherSrcRRAInfo, int vectorL, char **rraList);
+      MemGatherSrcRRAInfo *xxeMemGatherSrcRRAInfo, int vectorL, char **rraList,
+      int threadCount);
     template<typename T>
     inline static void exec_memGatherSrcRRASuper(
       MemGatherSrcRRAInfo *xxeMemGatherSrcRRAInfo, int vectorL, char **rraList,
       int size_r, int size_s, int size_t, int *size_i, int *size_j);
     template<typename T>
+    inline static void exec_memGatherSrcRRABlock(
+      MemGatherSrcRRABlockInfo *xxeMemGatherSrcRRABlockInfo, int vectorL,
+      char **rraList);
+    template<typename T>
+    inline static void exec_memScatterDstRRABlock(
+      MemScatterDstRRABlockInfo *xxeMemScatterDstRRABlockInfo, int vectorL,
+      char **rraList);
+    template<typename T>
     inline static void exec_zeroSuperScalarRRA(
       ZeroSuperScalarRRAInfo *xxeZeroSuperScalarRRAInfo, int vectorL, 
-      char **rraList);
+      char **rraList, int threadCount);
     template<typename T>
     inline static void exec_zeroSuperScalarRRASuper(
       ZeroSuperScalarRRAInfo *xxeZeroSuperScalarRRAInfo, int vectorL, 
@@ -1167,15 +1271,17 @@ class XXE{
       TKId valueTK, int termCount, int vectorL, int resolved,
       int localDeIndexOff,
       int size_r, int size_s, int size_t, int *size_i, int *size_j,
-      bool superVector);
+      bool superVector, int threadCount);
     template<typename T, typename U, typename V>
     static void exec_psssDstRra(T *rraBase, int *rraOffsetList, U *factorList,
-      V *valueBase, int *valueOffsetList, int termCount, int vectorL);
+      V *valueBase, int *valueOffsetList, int termCount, int vectorL,
+      int threadCount);
     template<typename T, typename U, typename V>
     static void exec_psssDstRraSuper(T *rraBase, int *rraOffsetList,
       U *factorList, V *valueBase, int *valueOffsetList, int termCount,
       int vectorL, int localDeIndexOff,
-      int size_r, int size_s, int size_t, int *size_i, int *size_j);
+      int size_r, int size_s, int size_t, int *size_i, int *size_j,
+      int threadCount);
     template<typename T, typename U, typename V>
     static void pssslDstRra(T **rraBaseList, int *rraIndexList, TKId elementTK,
       int *rraOffsetList, U *factorList, TKId factorTK, V **valueBaseList,
@@ -1183,12 +1289,12 @@ class XXE{
       TKId valueTK, int termCount, int vectorL, int resolved, 
       int localDeIndexOff,
       int size_r, int size_s, int size_t, int *size_i, int *size_j, 
-      bool superVector, RouteHandle *rh);
+      bool superVector, RouteHandle *rh, int threadCount);
     template<typename T, typename U, typename V>
     static void exec_pssslDstRra(T **rraBaseList, int *rraIndexList, 
       int *rraOffsetList, U *factorList, V **valueBaseList,
       int *valueOffsetList, int *baseListIndexList,
-      int termCount, int vectorL);
+      int termCount, int vectorL, int threadCount);
     template<typename T, typename U, typename V>
     static void exec_pssslDstRraDynMask(T **rraBaseList, int *rraIndexList, 
       int *rraOffsetList, U *factorList, V **valueBaseList,
@@ -1215,9 +1321,26 @@ class XXE{
       int vectorL, int localDeIndexOff, int size_r, int size_s, int size_t,
       int *size_i, int *size_j, bool superVector);
     template<typename T, typename U, typename V>
+    static void psCsrDstRra(T *rraBase, TKId elementTK, int *rowOffsetList,
+      int *rowStartList, U *factorList, TKId factorTK, V *valueBase,
+      int *valueOffsetList, TKId valueTK, int rowCount, int vectorL,
+      int resolved, int localDeIndexOff,
+      int size_r, int size_s, int size_t, int *size_i, int *size_j,
+      bool superVector, int threadCount);
+    template<typename T, typename U, typename V>
+    static void exec_psCsrDstRra(T *rraBase, int *rowOffsetList,
+      int *rowStartList, U *factorList, V *valueBase, int *valueOffsetList,
+      int rowCount, int vectorL, int threadCount);
+    template<typename T, typename U, typename V>
+    static void exec_psCsrDstRraSuper(T *rraBase, int *rowOffsetList,
+      int *rowStartList, U *factorList, V *valueBase, int *valueOffsetList,
+      int rowCount, int vectorL, int localDeIndexOff,
+      int size_r, int size_s, int size_t, int *size_i, int *size_j,
+      int threadCount);
+    template<typename T, typename U, typename V>
     static void pssscRra(T *rraBase, TKId elementTK, int *rraOffsetList,
       U *factorList, TKId factorTK, V *valueList, TKId valueTK,
-      int termCount, int vectorL, int resolved);
+      int termCount, int vectorL, int resolved, int threadCount);
 
     template<typename T, typename U, typename V> struct DynMaskElement{
       T *element;
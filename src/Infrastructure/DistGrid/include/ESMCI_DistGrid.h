@@ -55,6 +55,15 @@ namespace ESMCI {
 
   class DistGrid;
 
+  // run of consecutive arbitrary sequence indices
+  struct ArbSeqIndexRun{
+    int start;                    // position of first element in local list
+    ESMC_I8 seqIndex;             // sequence index of first element
+    bool operator==(ArbSeqIndexRun const &other)const{
+      return (start==other.start) && (seqIndex==other.seqIndex);
+    }
+  };
+
   // class definition
   class DistGrid : public ESMC_Base {    // inherits from ESMC_Base class
 
@@ -76,9 +85,22 @@ namespace ESMCI {
     int connectionCount;          // number of elements in connection list
     int **connectionList;         // connection elements
                                   // [connectionCount][2*dimCount+2]
+    std::vector<ESMC_I8> seqIndexStridePDimPTile; // canonical seqIndex stride
+                                  // [dimCount*tileCount]
+    std::vector<ESMC_I8> seqIndexBasePTile; // canonical seqIndex of the
+                                  // tile's min corner [tileCount]
+    std::vector<int> connectedFlagPTile; // tile is part of a connection
+                                  // [tileCount]
+    unsigned long long contentHash; // hash over the content compared by
+                                  // match(), local to the PET
     void ***arbSeqIndexListPCollPLocalDe;// local arb sequence indices
                                   // [diffCollocationCount][localDeCount]
                                   // [elementCountPCollPLocalDe(localDe)]
+    std::vector<ArbSeqIndexRun> **arbSeqIndexRunListPCollPLocalDe;
+                                  // compressed local arb sequence indices,
+                                  // replaces arbSeqIndexListPCollPLocalDe
+                                  // entry for lists made of long runs
+                                  // [diffCollocationCount][localDeCount]
     int *collocationPDim;         // collocation [dimCount]
     int diffCollocationCount;     // number different seqIndex collocations
     int *collocationTable;        // collocation in packed format 
@@ -123,6 +145,10 @@ namespace ESMCI {
       DELayout *delayout, bool delayoutCreator, VM *vm, 
       ESMC_TypeKind_Flag indexTKArg);
     int destruct(bool followCreator=true, bool noGarbage=false);
+    void setSeqIndexStrides();
+    void setContentHash();
+    template<typename T> bool getSequenceIndexOnTile(int tile,
+      int const *index, T *seqIndex)const;
    public:
     // create() and destroy()
     static DistGrid *create(DistGrid *dg,
@@ -278,6 +304,10 @@ namespace ESMCI {
       if (ESMC_BaseGetStatus()!=ESMF_STATUS_READY) throw ESMC_RC_OBJ_DELETED;
       return regDecomp;
     }
+    unsigned long long getContentHash() const {
+      if (ESMC_BaseGetStatus()!=ESMF_STATUS_READY) throw ESMC_RC_OBJ_DELETED;
+      return contentHash;
+    }
     // topology discovery
     template<typename T> int getSequenceIndexLocalDe(int localDe, 
       int const *index, std::vector<T> &seqIndex, bool recursive=true,
@@ -291,6 +321,8 @@ namespace ESMCI {
       std::vector<T> &seqIndex, bool recursive=true)const;
     template<typename T> int getSequenceIndexTileRecursive(int tile,
       int const *index, int depth, int hops, std::vector<T> &seqIndex)const;
+    template<typename T> int getSequenceIndexTileBox(int tile,
+      int const *minIndex, int const *maxIndex, T *seqIndexList)const;
     int getIndexTupleFromSeqIndex(int seqIndex, std::vector<int> &indexTuple,
       int &tile) const;
     // get/set arb sequence indices
@@ -298,7 +330,9 @@ namespace ESMCI {
       if (ESMC_BaseGetStatus()!=ESMF_STATUS_READY) throw ESMC_RC_OBJ_DELETED;
       return elementCountPCollPLocalDe;
     }
-    void const *getArbSeqIndexList(int localDe, int collocation=1, int *rc=NULL)
+    void const *getArbSeqIndexList(int localDe, int collocation,
+      std::vector<char> &buffer, int *rc=NULL) const;
+    bool hasArbSeqIndexList(int localDe, int collocation=1, int *rc=NULL)
       const;
     template<typename T> int setArbSeqIndex(std::vector<T> &arbSeqIndex, 
       int localDe, int collocation=1);
@@ -0,0 +1,125 @@
+// $Id$
+//
+// Earth System Modeling Framework
+// Copyright (c) 2002-2023, University Corporation for Atmospheric Research,
+// Massachusetts Institute of Technology, Geophysical Fluid Dynamics
+// Laboratory, University of Michigan, National Centers for Environmental
+// Prediction, Los Alamos National Laboratory, Argonne National Laboratory,
+// NASA Goddard Space Flight Center.
+// Licensed under the University of Illinois-NCSA License.
+
+// ESMCI BVHTree include file for C++
+
+// (all lines below between the !BOP and !EOP markers will be included in
+//  the automated document processing.)
+//-------------------------------------------------------------------------
+// these lines prevent this file from being read more than once if it
+// ends up being included multiple times
+
+#ifndef ESMCI_BVHTree_H
+#define ESMCI_BVHTree_H
+
+// FOR ESMF
+#include <Mesh/include/Legacy/ESMCI_Exception.h>
+
+#include <vector>
+
+//-------------------------------------------------------------------------
+//BOP
+// !CLASS: ESMCI_BVHTree - BVHTree
+//
+// !DESCRIPTION:
+//
+// The code in this file defines the C++ {\tt BVHTree} members and method
+// signatures (prototypes).  The companion file {\tt ESMCI\_BVHTree.C}
+// contains the full code (bodies) for the {\tt BVHTree} methods.
+// A {\tt BVHTree} is a bounding volume hierarchy over min-max boxes that is
+// bulk loaded with the Sort-Tile-Recursive (STR) method. Items and nodes
+// are kept in contiguous arrays, leaves first and the root last, so queries
+// walk memory mostly in order. Items are added with add() and the tree is
+// built once with commit(). It is searched either with the same callback
+// interface as {\tt OTree}, or with query() and query_batch(), which return
+// the data of the overlapping items directly.
+//
+///EOP
+//-------------------------------------------------------------------------
+
+
+// Start name space
+namespace ESMCI {
+
+  // Item stored in tree
+  class BVHItem {
+  public:
+    double min[3],max[3];
+
+    void *data;
+  };
+
+  // Node of tree, covers num consecutive items (leaf node) or nodes starting
+  // at first
+  class BVHNode {
+  public:
+    double min[3],max[3];
+
+    int first;
+    int num;
+  };
+
+
+// class definition
+class BVHTree {
+
+ private:
+
+  // Items, in tree order after commit
+  std::vector<BVHItem> items;
+  int max_size_items;
+
+  // Nodes, the leaves come first, the root is the last node
+  std::vector<BVHNode> nodes;
+  int num_leaves;
+
+  // committed
+  bool is_committed;
+
+ public:
+
+  // Number of children of a node and of items in a leaf
+  static const int fanout=8;
+
+  // BVHTree Construct
+  BVHTree(int max_size);
+
+  // BVHTree Destruct
+  ~BVHTree();
+
+  // Add item to tree
+  void add(double min[3], double max[3], void *data);
+
+  // Build tree
+  void commit();
+
+  // Number of items in tree
+  int size() const {return items.size();}
+
+  // Get the data of each item overlapping min-max, appended to found
+  void query(const double min[3], const double max[3],
+             std::vector<void *> &found) const;
+
+  // Query num min-max boxes (3 doubles per box in mins and maxs). The data
+  // found for box i is found[offsets[i]] to found[offsets[i+1]-1].
+  void query_batch(int num, const double *mins, const double *maxs,
+                   std::vector<int> &offsets, std::vector<void *> &found) const;
+
+  int runon(double [], double [], int (*func)(void *,void *),void *);
+
+  int runon_mm_chng(double [], double [],
+         int (*func)(void *, void *, double *, double *),void *);
+
+};  // end class BVHTree
+
+
+} // END ESMCI namespace
+
+#endif  // ESMCI_BVHTree_H
@@ -0,0 +1,121 @@
+// $Id$
+//
+// Earth System Modeling Framework
+// Copyright (c) 2002-2023, University Corporation for Atmospheric Research,
+// Massachusetts Institute of Technology, Geophysical Fluid Dynamics
+// Laboratory, University of Michigan, National Centers for Environmental
+// Prediction, Los Alamos National Laboratory, Argonne National Laboratory,
+// NASA Goddard Space Flight Center.
+// Licensed under the University of Illinois-NCSA License.
+
+// ESMCI KDTree include file for C++
+
+// (all lines below between the !BOP and !EOP markers will be included in
+//  the automated document processing.)
+//-------------------------------------------------------------------------
+// these lines prevent this file from being read more than once if it
+// ends up being included multiple times
+
+#ifndef ESMCI_KDTree_H
+#define ESMCI_KDTree_H
+
+// FOR ESMF
+#include <Mesh/include/Legacy/ESMCI_Exception.h>
+
+#include <vector>
+
+//-------------------------------------------------------------------------
+//BOP
+// !CLASS: ESMCI_KDTree - KDTree
+//
+// !DESCRIPTION:
+//
+// The code in this file defines the C++ {\tt KDTree} members and method
+// signatures (prototypes).  The companion file {\tt ESMCI\_KDTree.C}
+// contains the full code (bodies) for the {\tt KDTree} methods.
+// A {\tt KDTree} is a static k-d tree over 3D points for nearest neighbor
+// search. Points are added with add() and the tree is built once with
+// commit() by splitting at the median of the widest dimension. Points and
+// nodes are kept in contiguous arrays. nearest() returns the k nearest
+// points to a query point, ordered by distance and, at equal distance, by
+// id, so the result doesn't depend on the order the points were added in.
+// nearest_batch() does the same for many query points, split over the
+// OpenMP threads of the PET.
+//
+///EOP
+//-------------------------------------------------------------------------
+
+
+// Start name space
+namespace ESMCI {
+
+  // Node of tree, covers the num points starting at first. Leaves have no
+  // children (left == -1).
+  class KDNode {
+  public:
+    double min[3],max[3];
+
+    int first;
+    int num;
+
+    int left,right;
+  };
+
+
+// class definition
+class KDTree {
+
+ private:
+
+  // Points, in tree order after commit
+  std::vector<double> coords;  // 3 per point
+  std::vector<int> ids;
+  std::vector<int> locs;       // Position of point in the order it was added
+  int max_size_pnts;
+
+  // Nodes, the root is the first node
+  std::vector<KDNode> nodes;
+
+  // committed
+  bool is_committed;
+
+ public:
+
+  // Maximum number of points in a leaf
+  static const int leaf_size=8;
+
+  // KDTree Construct
+  KDTree(int max_size);
+
+  // KDTree Destruct
+  ~KDTree();
+
+  // Add point with id to tree, points are numbered (loc) in the order
+  // they are added
+  void add(const double pnt[3], int id);
+
+  // Build tree
+  void commit();
+
+  // Number of points in tree
+  int size() const {return ids.size();}
+
+  // Find the (up to) k nearest points at squared distance <= max_dist2.
+  // Returns the number found, their locs and squared distances are put in
+  // found_locs and found_dist2 (which must hold k entries).
+  int nearest(const double pnt[3], int k, double max_dist2,
+              int *found_locs, double *found_dist2) const;
+
+  // Call nearest() for num points (3 doubles per point in pnts). If
+  // max_dist2 isn't NULL it holds the bound for each point. The results of
+  // point i are num_found[i] and found_locs[k*i..], found_dist2[k*i..].
+  void nearest_batch(int num, const double *pnts, const double *max_dist2,
+                     int k, int *num_found, int *found_locs,
+                     double *found_dist2) const;
+
+};  // end class KDTree
+
+
+} // END ESMCI namespace
+
+#endif  // ESMCI_KDTree_H
@@ -25,6 +25,8 @@
 
 namespace ESMCI {
 
+  class MeshCSR;
+
   bool is_outside_hex_sph3D_xyz(const double *hex_xyz, const double *pnt_xyz);
 
   bool calc_p_hex_sph3D_xyz(const double *hex_xyz, const double *pnt_xyz, double *p);
@@ -43,13 +45,15 @@ namespace ESMCI {
 
   double tri_area(const double * const u, const double * const v, const double * const w);
 
-  void get_elem_coords(const MeshObj *elem, const MEField<>  *cfield, int sdim, int max_num_nodes, int *num_nodes, double *coords);
+  // If csr isn't NULL and holds elem, the coords are taken from it instead of cfield
+  void get_elem_coords(const MeshObj *elem, const MEField<>  *cfield, int sdim, int max_num_nodes, int *num_nodes, double *coords,
+                       const MeshCSR *csr=NULL);
 
   void get_elem_coords_2D_ccw(const MeshObj *elem, MEField<>  *cfield, int max_num_nodes,double *tmp_coords,
-                              int *num_nodes, double *coords);
+                              int *num_nodes, double *coords, const MeshCSR *csr=NULL);
 
   void get_elem_coords_3D_ccw(const MeshObj *elem, MEField<>  *cfield, int max_num_nodes,double *tmp_coords,
-                              int *num_nodes, double *coords);
+                              int *num_nodes, double *coords, const MeshCSR *csr=NULL);
 
   void get_elem_coords_and_ids(const MeshObj *elem, MEField<>  *cfield, int sdim, int max_num_nodes, int *num_nodes, double *coords, int *ids);
 
@@ -120,6 +124,10 @@ int calc_gc_parameters_tri(const double *pnt, double *t1, double *t2, double *t3
                                double *tmp,
                                int *num_out, double *out);
 
+  void intersect_convex_poly2D_batch(int num_batch, const int *num_p, const double *p, int p_stride,
+                                     int num_q, const double *q,
+                                     int *num_out, double *area);
+
 //// Handy macros ////
 
 // Do it this way because some compilers don't support isfinite (e.g. pgi)
@@ -23,6 +23,7 @@
 #include "Field/include/ESMCI_Field.h"
 
 #include <map>
+#include <memory>
 #include <mpi.h>
 
 /**
@@ -39,6 +40,8 @@ namespace ESMCI {
   // Defines for Mesh
 #define MESH_POLYBREAK_IND -7
 
+class MeshCSR;
+
   /**
    * Basic parallel mesh operations.  Aggregates the serial meshes,
    * the list of fields, and the parallel communiation relations.
@@ -128,6 +131,18 @@ void resolve_cspec_delete_owners(UInt obj_type);
 
 ESMCI::PointList *MeshToPointList(ESMC_MeshLoc_Flag meshLoc, ESMCI::InterArray<int> *maskValuesArg, bool add_orig_coords, int *rc);
 
+/**
+ * Flat copy of the element coords and connectivity used by the regrid
+ * search and weight calculation.  Built on first use and kept until
+ * InvalidateCSR() or a change of the mesh.  The Interp object calls
+ * InvalidateCSR() on its meshes when it's destroyed, so the copy only
+ * lives for one regrid.  Code that moves the nodes of a committed mesh in
+ * place must also call InvalidateCSR().
+ */
+const MeshCSR &GetCSR() const;
+
+void InvalidateCSR() const;
+
   
   public:
 // STUFF FOR SPLIT MESH
@@ -153,6 +168,8 @@ ESMCI::PointList *MeshToPointList(ESMC_MeshLoc_Flag meshLoc, ESMCI::InterArray<i
 void assign_new_ids();
 CommReg *sghost;
 bool committed;
+mutable std::unique_ptr<MeshCSR> csr;
+mutable UInt csr_num_elems, csr_num_nodes;
 };
 
 } // namespace
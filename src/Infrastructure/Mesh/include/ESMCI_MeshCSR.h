@@ -0,0 +1,126 @@
+// $Id$
+//
+// Earth System Modeling Framework
+// Copyright (c) 2002-2023, University Corporation for Atmospheric Research,
+// Massachusetts Institute of Technology, Geophysical Fluid Dynamics
+// Laboratory, University of Michigan, National Centers for Environmental
+// Prediction, Los Alamos National Laboratory, Argonne National Laboratory,
+// NASA Goddard Space Flight Center.
+// Licensed under the University of Illinois-NCSA License.
+
+// ESMCI MeshCSR include file for C++
+
+// (all lines below between the !BOP and !EOP markers will be included in
+//  the automated document processing.)
+//-------------------------------------------------------------------------
+// these lines prevent this file from being read more than once if it
+// ends up being included multiple times
+
+#ifndef ESMCI_MeshCSR_H
+#define ESMCI_MeshCSR_H
+
+// FOR ESMF
+#include <Mesh/include/ESMCI_Mesh.h>
+#include <Mesh/include/Legacy/ESMCI_MeshObj.h>
+#include <Mesh/include/Legacy/ESMCI_Exception.h>
+
+#include <vector>
+#include <unordered_map>
+
+//-------------------------------------------------------------------------
+//BOP
+// !CLASS: ESMCI_MeshCSR - MeshCSR
+//
+// !DESCRIPTION:
+//
+// The code in this file defines the C++ {\tt MeshCSR} members and method
+// signatures (prototypes).  The companion file {\tt ESMCI\_MeshCSR.C}
+// contains the full code (bodies) for the {\tt MeshCSR} methods.
+// A {\tt MeshCSR} is a read only, flat copy of the element to node
+// connectivity and the node coordinates of a {\tt Mesh}. It's built once
+// from the active elements of the mesh and then used where the regrid code
+// gathers element coordinates over and over. The coordinates are kept in
+// one contiguous array (numbered in the order the elements first use the
+// nodes), the nodes of element e are elem_node_inds[elem_node_offsets[e]]
+// to elem_node_inds[elem_node_offsets[e+1]-1], and a table (or a hash
+// when the ids are spread out) maps element ids to their position.
+// {\tt Mesh::GetCSR()} keeps one {\tt MeshCSR} per {\tt Mesh} and drops it
+// when the mesh changes or the regrid that used it is done.
+//
+///EOP
+//-------------------------------------------------------------------------
+
+
+// Start name space
+namespace ESMCI {
+
+// class definition
+class MeshCSR {
+
+ private:
+
+  int sdim;
+
+  // Node coordinates, sdim per node
+  std::vector<double> node_coords;
+
+  // Element ids and element to node connectivity
+  std::vector<MeshObj::id_type> elem_ids;
+  std::vector<int> elem_node_offsets;  // num_elems()+1 entries
+  std::vector<int> elem_node_inds;
+
+  // Element id to position. If the ids are close to contiguous, which is
+  // the usual case, this is a table indexed by id-min_elem_id, otherwise a
+  // hash.
+  MeshObj::id_type min_elem_id;
+  std::vector<int> elem_table;
+  std::unordered_map<MeshObj::id_type, int> elem_map;
+
+ public:
+
+  // MeshCSR Construct from the coordinate field of mesh
+  MeshCSR(const Mesh &mesh);
+
+  // MeshCSR Destruct
+  ~MeshCSR();
+
+  int spatial_dim() const {return sdim;}
+
+  int num_elems() const {return elem_ids.size();}
+
+  int num_nodes() const {return node_coords.size()/(sdim > 0 ? sdim : 1);}
+
+  // Position of the element with id, -1 if it isn't in the MeshCSR
+  int elem_index(MeshObj::id_type id) const {
+    if (!elem_table.empty()) {
+      MeshObj::id_type t=id-min_elem_id;
+      return ((t < 0) || (t >= (MeshObj::id_type)elem_table.size())) ? -1 : elem_table[t];
+    }
+    std::unordered_map<MeshObj::id_type, int>::const_iterator mi=elem_map.find(id);
+    return (mi == elem_map.end()) ? -1 : mi->second;
+  }
+
+  MeshObj::id_type elem_id(int e) const {return elem_ids[e];}
+
+  int elem_num_nodes(int e) const {
+    return elem_node_offsets[e+1]-elem_node_offsets[e];
+  }
+
+  const int *elem_nodes(int e) const {
+    return &elem_node_inds[0]+elem_node_offsets[e];
+  }
+
+  const double *node_coord(int n) const {
+    return &node_coords[0]+sdim*n;
+  }
+
+  // Get the coords of element e (sdim per node) like get_elem_coords() in
+  // ESMCI_MathUtil.h
+  void get_elem_coords(int e, int max_num_nodes, int *num_nodes, double *coords) const;
+
+};  // end class MeshCSR
+
+
+} // END ESMCI namespace
+
+#endif  // ESMCI_MeshCSR_H
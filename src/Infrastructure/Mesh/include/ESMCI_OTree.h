@@ -21,6 +21,7 @@
 
 // FOR ESMF
 #include <Mesh/include/Legacy/ESMCI_Exception.h>
+#include <Mesh/include/ESMCI_BVHTree.h>
 
 // OUTSIDE ESMF
 //#include "ESMCI_Exception.h"
@@ -38,6 +39,13 @@
 // put full ref here when paper is done making its way through 
 // publication process. 
 //
+// When committed with commit() the items can alternatively be searched
+// through a bulk loaded {\tt BVHTree}. Which structure is used is selected
+// when the tree is constructed, by default through the
+// ESMF\_RUNTIME\_SEARCH\_TREE runtime environment variable. The BVH is used
+// unless it is set to OTREE.
+// Items added with add\_commit() are always searched through the OTree.
+//
 ///EOP
 //-------------------------------------------------------------------------
 
@@ -49,6 +57,9 @@ class OTree;
 
 class ONode;
 
+  // Search structure that OTree::commit() builds
+  enum OTreeType {OTREE_TYPE_OTREE=0, OTREE_TYPE_BVH};
+
   // Nodes which make up tree
   class ONode {
   public:
@@ -82,11 +93,18 @@ class OTree {    // inherits from ESMC_Base class
   // committed
   bool is_committed;
 
+  // Search structure built on commit(), and the BVH if built
+  OTreeType type;
+  BVHTree *bvh;
+
  public:
 
-  // OTree Construct 
+  // OTree Construct, the type comes from ESMF_RUNTIME_SEARCH_TREE
   OTree(int max_size);
 
+  // OTree Construct with given type
+  OTree(int max_size, OTreeType type);
+
   // OTree Destruct
   ~OTree();
 
@@ -103,6 +121,16 @@ class OTree {    // inherits from ESMC_Base class
 
  int runon_mm_chng(double [], double [],
         int (*func)(void *, void *, double *, double *),void *);
+
+ // Get the data of each item overlapping min-max, appended to found
+ void query(double min[3], double max[3], std::vector<void *> &found);
+
+ // Query num min-max boxes, see BVHTree::query_batch()
+ void query_batch(int num, const double *mins, const double *maxs,
+                  std::vector<int> &offsets, std::vector<void *> &found);
+
+ // Type of search structure built on commit()
+ OTreeType get_type() const {return type;}
    
 
 
@@ -25,6 +25,8 @@
 
 namespace ESMCI {
 
+  class MeshCSR;
+
   struct interp_res{
     const MeshObj * clip_elem;
     int num_sintd_nodes;
@@ -74,7 +76,8 @@ namespace ESMCI {
                                          Mesh * midmesh, std::vector<sintd_node *> * sintd_nodes, std::vector<sintd_cell *> * sintd_cells,
                                          interp_mapp res_map, struct Zoltan_Struct * zz, 
                                          MEField<> *src_side1_mesh_ind_field=NULL, MEField<> *src_side1_orig_elem_id_field=NULL, 
-                                         MEField<> *dst_side2_mesh_ind_field=NULL, MEField<> *dst_side2_orig_elem_id_field=NULL);
+                                         MEField<> *dst_side2_mesh_ind_field=NULL, MEField<> *dst_side2_orig_elem_id_field=NULL,
+                                         const MeshCSR *src_csr=NULL, const MeshCSR *dst_csr=NULL);
 
 
   void calc_1st_order_weights_2D_3D_sph(const MeshObj *src_elem, MEField<> *src_cfield, 
@@ -85,7 +88,8 @@ namespace ESMCI {
                                         Mesh * midmesh, std::vector<sintd_node *> * sintd_nodes, std::vector<sintd_cell *> * sintd_cells, 
 					interp_mapp res_map, struct Zoltan_Struct * zz, 
                                         MEField<> *src_side1_mesh_ind_field=NULL, MEField<> *src_side1_orig_elem_id_field=NULL, 
-                                        MEField<> *dst_side2_mesh_ind_field=NULL, MEField<> *dst_side2_orig_elem_id_field=NULL);
+                                        MEField<> *dst_side2_mesh_ind_field=NULL, MEField<> *dst_side2_orig_elem_id_field=NULL,
+                                        const MeshCSR *src_csr=NULL, const MeshCSR *dst_csr=NULL);
  
   void calc_1st_order_weights_3D_3D_cart(const MeshObj *src_elem, MEField<> *src_cfield,
                                            std::vector<const MeshObj *> dst_elems, MEField<> *dst_cfield, MEField<> *dst_mask_field, MEField<> * dst_frac2_field,
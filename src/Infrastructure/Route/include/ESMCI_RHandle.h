@@ -72,10 +72,17 @@ namespace ESMCI {
     //TODO: Arrays to persist
     Array *srcArray;
     Array *dstArray;
+    // local fingerprints of the src/dst Arrays, persist through write/read
+    unsigned long long srcFingerprint;  // 0: unknown
+    unsigned long long dstFingerprint;  // 0: unknown
     char *asPtr;    // attached state pointer, used to carry Fortran info around
     void *srcMaskValue;
     void *dstMaskValue;
     bool handleAllElements;
+    int execThreadCount;  // threads used for local compute ops during exec
+    bool persistentComm;  // use persistent MPI requests during exec
+    bool ssiShmComm;      // use SSI shared memory channels during exec
+    bool cacheHit;        // created from the route cache
    public:
     RouteHandle():ESMC_Base(-1){    // use Base constructor w/o BaseID increment
       // initialize the name for this RouteHandle object in the Base class
@@ -83,6 +90,10 @@ namespace ESMCI {
       srcMaskValue=NULL;
       dstMaskValue=NULL;
       handleAllElements=false;
+      execThreadCount=1;
+      persistentComm=false;
+      ssiShmComm=false;
+      cacheHit=false;
     }
     ~RouteHandle(){destruct();}
     static RouteHandle *create(int *rc);
@@ -154,13 +165,59 @@ namespace ESMCI {
     bool getHandleAllElements(){
       return handleAllElements;
     }
+    
+    // threaded execution of local compute operations
+    int setExecThreadCount(int execThreadCount_){
+      if (execThreadCount_<1) return ESMC_RC_ARG_OUTOFRANGE;
+      execThreadCount = execThreadCount_;
+      return ESMF_SUCCESS;
+    }
+    int getExecThreadCount()const{
+      return execThreadCount;
+    }
+    
+    // execution of non-blocking communications via persistent MPI requests
+    void setPersistentComm(bool persistentComm_){
+      persistentComm = persistentComm_;
+    }
+    bool getPersistentComm()const{
+      return persistentComm;
+    }
+    
+    // execution of non-blocking communications via SSI shared memory
+    void setSsiShmComm(bool ssiShmComm_){
+      ssiShmComm = ssiShmComm_;
+    }
+    bool getSsiShmComm()const{
+      return ssiShmComm;
+    }
         
     // fingerprinting of src/dst Arrays
     int fingerprint(Array *srcArrayArg, Array *dstArrayArg){
       srcArray = srcArrayArg;
       dstArray = dstArrayArg;
+      srcFingerprint = arrayFingerprint(srcArrayArg);
+      dstFingerprint = arrayFingerprint(dstArrayArg);
       return ESMF_SUCCESS;
     }
+    static unsigned long long arrayFingerprint(Array const *array);
+    bool matchFingerprint(Array const *srcArrayArg, Array const *dstArrayArg)
+      const;
+    static unsigned long long hashBytes(void const *data, size_t size,
+      unsigned long long hash=14695981039346656037ULL);
+    
+    // route cache, enabled via ESMF_RUNTIME_ROUTECACHE[_DIR]
+    static bool cacheEnabled();
+    static RouteHandle *cacheCreate(unsigned long long key,
+      unsigned long long localKey, Array const *srcArrayArg,
+      Array const *dstArrayArg, bool tuneValuesNeeded, int *srcTermProcessing,
+      int *pipelineDepth, int *rc);
+    int cacheInsert(unsigned long long key, unsigned long long localKey,
+      int srcTermProcessing, int pipelineDepth) const;
+    static void cacheFinal();
+    bool getCacheHit()const{
+      return cacheHit;
+    }
         
     // required methods inherited and overridden from the ESMC_Base class
     int validate() const;
@@ -23,6 +23,7 @@
  // include files.
 
 #include <string>
+#include <cstring>
 #include "ESMC_Util.h"
 
 //-----------------------------------------------------------------------------
@@ -254,4 +255,23 @@ extern ESMC_ObjectID ESMC_ID_XGRID;
 extern ESMC_ObjectID ESMC_ID_XGRIDGEOMBASE;
 extern ESMC_ObjectID ESMC_ID_NONE;
 
+namespace ESMCI{
+  // Serialization by views: objects contribute contiguous views of their
+  // existing member arrays, each gathered into the byte stream at cp with a
+  // single block copy. For ESMF_INQUIREONLY only cp is advanced.
+  template<typename T> inline void serializeView(char *&cp, T const *data,
+    int count, ESMC_InquireFlag inquireflag){
+    if (inquireflag != ESMF_INQUIREONLY && count > 0)
+      memcpy(cp, data, sizeof(T)*count);
+    cp += sizeof(T)*count;
+  }
+  // Scatter a contiguous view from the byte stream at cp into a member array.
+  template<typename T> inline void deserializeView(char *&cp, T *data,
+    int count){
+    if (count > 0)
+      memcpy(data, cp, sizeof(T)*count);
+    cp += sizeof(T)*count;
+  }
+} // namespace ESMCI
+
 #endif  // ESMCI_UTIL_H
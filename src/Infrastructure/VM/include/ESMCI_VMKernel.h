@@ -26,6 +26,7 @@
 #include <string>
 #include <sstream>
 #include <queue>
+#include <deque>
 #if (EPOCH_BUFFER_OPTION == 0)
 #include <strstream>
 #elif (EPOCH_BUFFER_OPTION == 2)
@@ -156,14 +157,62 @@ class VMK{
 
   // structs
 
+  struct ssishmChannel;
+
   struct commhandle{
     commhandle *prev_handle;// previous handle in the queue
     commhandle *next_handle;// next handle in the queue
+    VMK *queueVMK = NULL;   // VMK holding the handle in its queue, or NULL
     int nelements;          // number of elements
-    int type;       // 0: commhandle container, 1: MPI_Requests, 2: ... reserved
+    int type;       // 0: commhandle container, 1: MPI_Requests,
+                    // 2: persistent MPI_Requests,
+                    // 3: SSI shared memory channel transfer
     bool sendFlag;          // true if this is a send request
     commhandle **handles;   // sub handles
     MPI_Request *mpireq;    // request array
+    MPI_Request mpireqSingle;     // storage for single request, no allocation
+    // binding of persistent MPI_Requests (type 2)
+    bool persistentFlag = false;  // true if mpireq holds persistent requests
+    const void *persistentMessage = NULL; // message buffer bound to requests
+    unsigned long long int persistentSize = 0;  // message size in bytes
+    int persistentPeer = -1;      // dest or source PET bound to the requests
+    int persistentTag = -1;       // tag bound to the requests
+    // requests driven by the progress thread (type 1 and 2)
+    bool progressFlag = false;    // true while held by the progress thread
+    // SSI shared memory channel transfer (type 3)
+    bool ssishmFlag = false;      // true if held by an SSI shm channel
+    bool ssishmComplete;          // true once the transfer has completed
+    char *ssishmMessage;          // message buffer
+    unsigned long long int ssishmSize;  // message size in bytes
+    unsigned long long int ssishmDone;  // bytes transferred, incl. header
+    unsigned long long int ssishmHeader[2]; // message header: size, tag
+    int ssishmPeer;               // dest or source PET
+    int ssishmTag;                // tag posted with the transfer
+    bool ssishmError;             // true if the transfer has failed
+    VMK *ssishmVMK = NULL;        // VMK progressing the transfer, or NULL
+    ssishmChannel *ssishmChan;    // channel queue holding the transfer
+    // request array management
+    void mpireqAlloc(int n){
+      mpireq = (n<=1) ? &mpireqSingle : new MPI_Request[n];
+    }
+    void mpireqFree(){
+      if (mpireq != &mpireqSingle) delete [] mpireq;
+    }
+    // pooled allocation, avoiding heap traffic for short lived commhandles
+    static void *operator new(size_t size);
+    static void operator delete(void *ptr);
+  };
+
+  struct ssishmChannel{
+    // Single producer, single consumer ring buffer located in an MPI-3 shared
+    // memory window, carrying the messages from one PET to another PET on the
+    // same SSI in the order they were posted.
+    volatile unsigned long long int *head;  // bytes written by the sender
+    volatile unsigned long long int *tail;  // bytes consumed by the receiver
+    char *data;                             // ring buffer
+    unsigned long long int capacity;        // size of ring buffer in bytes
+    std::deque<commhandle *> queue;         // pending transfers, in order
+    bool broken = false;  // true after a failed transfer, fails all others
   };
 
   struct memhandle{
@@ -332,6 +381,8 @@ class VMK{
     MPI_Comm mpi_c;     // communicator across the entire VM
     MPI_Comm mpi_c_ssi; // communicator holding PETs on the same SSI
     MPI_Comm mpi_c_ssi_roots; // communicator holding root PETs on each SSI
+    MPI_Comm mpi_c_sparse; // dup of mpi_c for sparse_alltoall(), on first use
+    int sparseTagBase;     // alternates between sparse_alltoall() calls
     // Shared mutex and thread_finish variables. These are pointers that will be
     // pointing to shared memory variables between different thread-instances of
     // the VMK object.
@@ -352,12 +403,28 @@ class VMK{
     // Communication requests queue
     int nhandles;
     commhandle *firsthandle;
+    commhandle *lasthandle;
     // Epoch support
     vmEpoch epoch;
     int epochThrottle;
     bool pastFirst; // true if the first epoch enabled call has been made
     std::map<int, sendBuffer> sendMap;
     std::map<int, recvBuffer> recvMap;
+    // SSI shared memory channels
+    std::map<int, ssishmChannel> ssishmSendChannel; // keyed by dest PET
+    std::map<int, ssishmChannel> ssishmRecvChannel; // keyed by source PET
+    std::vector<int> ssishmPetList; // PET of each rank in mpi_c_ssi
+#ifndef ESMF_MPIUNI
+    std::vector<MPI_Win> ssishmWins;// shared memory windows holding channels
+#endif
+    int ssishmPending;              // number of pending channel transfers
+    // SSI hierarchical collectives
+    int ssiCollFlag;      // -1: follow ssiCollDefault, 0: off, 1: on
+    static bool ssiCollDefault; // set via ESMF_RUNTIME_COLLECTIVES_SSI
+    int ssiCollSsi;       // index of the local SSI, or -1 before set up
+    std::vector<int> ssiCollPetList;  // PETs ordered by SSI, then local rank
+    std::vector<int> ssiCollSsiStart; // start of each SSI in ssiCollPetList
+    std::vector<int> ssiCollPetPos;   // position of each PET in ssiCollPetList
     // static info of physical machine
     static int nssiid;  // total number of single system image ids
     static int ncores;  // total number of cores in the physical machine
@@ -405,6 +472,22 @@ class VMK{
     void obtain_args();
     void commqueueitem_link(commhandle *commh);
     int  commqueueitem_unlink(commhandle *commh);
+    int  commstartpersistent(const void *message, unsigned long long int size,
+      int peer, int tag, bool sendFlag, commhandle **commh);
+    int  commstartssishm(ssishmChannel *channel, const void *message,
+      unsigned long long int size, int peer, int tag, bool sendFlag,
+      commhandle **commh);
+    bool ssishmPush(ssishmChannel *channel, commhandle *commh);
+    bool ssishmPull(ssishmChannel *channel, commhandle *commh);
+    void ssishmProgress();
+    void ssishmUnqueue(commhandle *commh);
+    bool ssiCollEnabled();
+    int  ssiCollSetup();
+    int  ssiCollAllgatherv(void *in, int inCount, void *out, int *outCounts,
+      int *outOffsets, MPI_Datatype mpitype, int size);
+    int  ssiCollBroadcast(void *data, int len, int root);
+    int  sparseAlltoallExchange(int *in, int *out, bool ssiAggregate,
+      std::vector<MPI_Request> &sendReqs);
   public:
     static void InitPreMPI();
       // initialization step before MPI is initialized
@@ -478,6 +561,11 @@ class VMK{
     int getSsiLocalDevCount() const {return ssiLocalDevCount;}
     const int *getSsiLocalDevList() const {return ssiLocalDevList;}
     int getDevCount() const {return devCount;}
+    int getSsiCollectives() const {return ssiCollFlag;}
+
+    // set() calls
+    void setSsiCollectives(int flag){ssiCollFlag = flag;}
+    static void setSsiCollectivesDefault(bool flag){ssiCollDefault = flag;}
     esmf_pthread_t getLocalPthreadId() const {return mypthid;}
     static bool isPthreadsEnabled(){
 #ifdef ESMF_NO_PTHREADS
@@ -529,6 +617,16 @@ class VMK{
       int tag=-1, status *status=NULL);
     int recv(void *message, unsigned long long int size, int source,
       commhandle **commh, int tag=-1);
+    // p2p non-blocking calls via persistent MPI requests
+    int sendpersistent(const void *message, unsigned long long int size,
+      int dest, commhandle **commh, int tag=-1);
+    int recvpersistent(void *message, unsigned long long int size, int source,
+      commhandle **commh, int tag=-1);
+    // p2p non-blocking calls via SSI shared memory channels
+    int sendssishm(const void *message, unsigned long long int size,
+      int dest, commhandle **commh, int tag=-1);
+    int recvssishm(void *message, unsigned long long int size, int source,
+      commhandle **commh, int tag=-1);
 
     int sendrecv(void *sendData, int sendSize, int dst, void *recvData,
       int recvSize, int src, int dstTag=-1, int srcTag=-1);
@@ -572,6 +670,7 @@ class VMK{
       vmType type);
     int alltoallv(void *in, int *inCounts, int *inOffsets, void *out, 
       int *outCounts, int *outOffsets, vmType type);
+    int sparse_alltoall(int *in, int *out, bool ssiAggregate=false);
 
     int broadcast(void *data, int len, int root);
     int broadcast(void *data, int len, int root, commhandle **commh);
@@ -579,8 +678,18 @@ class VMK{
     // non-blocking service calls
     int commtest(commhandle **commh, int *completeFlag, status *status=NULL);
     int commwait(commhandle **commh, status *status=NULL, int nanopause=0);
+    int commwaitall(int count, commhandle ***commhList,
+      status *statusList=NULL);
     void commqueuewait();
+    // background thread driving the outstanding MPI_Requests of the
+    // commhandles, one per process
+    static int progressStart(int interval);
+    static void progressStop();
+    static bool progressRunning();
+    static void progressRegister(commhandle *ch);
+    static void progressUnregister(commhandle *ch);
     void commcancel(commhandle **commh);
+    static void commfree(commhandle *commh);
     bool cancelled(status *status);
 
     // SSI shared memory methods
@@ -592,6 +701,8 @@ class VMK{
     int ssishmGetLocalPet(memhandle memh){return memh.localPet;}
     int ssishmGetLocalPetCount(memhandle memh){return memh.localPetCount;}
     int ssishmSync(memhandle memh);
+    int ssishmChannelSetup(std::vector<int> &dstPetList);
+    void ssishmChannelFinal();
 
     // IntraProcessSharedMemoryAllocation Table Methods
     void *ipshmallocate(int bytes, int *firstFlag=NULL);